@@ -34,6 +34,12 @@ typedef struct BDD {
     HashTable *hash_table;
 } BDD;
 
+typedef struct ZDD {
+    BDDNode *root;
+    char *var_order;
+    HashTable *hash_table;
+} ZDD;
+
 typedef struct Minterm {
     int zero_flag;
     char *vars;
@@ -433,6 +439,326 @@ BDD *create_BDD_with_best_order(char *expr, char *var_seq) {
     return best;
 }
 
+typedef struct CacheEntry {
+    char *expr;                     // normalized expression
+    char *vars;                     // normalized variable sequence
+    char *order;                    // best order found for them
+    BDD *bdd;                       // built BDD, NULL if only the order is known (loaded from disk)
+    struct CacheEntry *next;        // for collisions
+    struct CacheEntry *lru_prev;    // towards most recently used
+    struct CacheEntry *lru_next;    // towards least recently used
+} CacheEntry;
+
+typedef struct BDDCache {
+    CacheEntry **list;
+    int size;                       // number of buckets, a power of two not below capacity
+    int capacity;
+    int count;
+    CacheEntry *lru_head;           // most recently used
+    CacheEntry *lru_tail;           // least recently used, evicted first
+    long hits;
+    long misses;
+    long evictions;
+} BDDCache;
+
+unsigned int hash_key(BDDCache *cache, const char *expr, const char *vars) {
+    unsigned long hash = 5381;
+    for (const char *p = expr; *p; p++) hash = hash * 33 + (unsigned char)*p;
+    hash = hash * 33 + '|';
+    for (const char *p = vars; *p; p++) hash = hash * 33 + (unsigned char)*p;
+    return (unsigned int)(hash & (cache->size - 1));
+}
+
+// keeps only the characters parse() looks at, so "ab + c" and "ab+c" share an entry
+char *normalize_expression(const char *expr) {
+    if (!expr) return strdup("");
+
+    char *normalized = malloc(strlen(expr) + 2);
+    int j = 0;
+    for (int i = 0; expr[i]; i++) {
+        char c = expr[i];
+        if (c == '!' || c == '+' || (c >= 'a' && c <= 'z')) {
+            normalized[j++] = c;
+        }
+    }
+
+    if (j == 0 && expr[0]) {        // non-empty input without letters is a minterm with no variables (true),
+        normalized[j++] = '+';      // while "" is false, so it needs a key of its own
+    }
+    normalized[j] = '\0';
+    return normalized;
+}
+
+// lowercase like create_BDD, whitespace is dropped
+char *normalize_vars(const char *var_seq) {
+    if (!var_seq) return strdup("");
+
+    char *normalized = malloc(strlen(var_seq) + 1);
+    int j = 0;
+    for (int i = 0; var_seq[i]; i++) {
+        if (!isspace((unsigned char)var_seq[i])) {
+            normalized[j++] = tolower(var_seq[i]);
+        }
+    }
+    normalized[j] = '\0';
+    return normalized;
+}
+
+BDDCache *create_bdd_cache(int capacity) {
+    BDDCache *cache = calloc(1, sizeof(BDDCache));
+    cache->capacity = capacity > 0 ? capacity : 1;
+
+    cache->size = 1;        // about one entry per bucket when the cache is full
+    while (cache->size < cache->capacity && cache->size < (1 << 30)) {
+        cache->size <<= 1;
+    }
+    cache->list = calloc(cache->size, sizeof(CacheEntry*));
+
+    return cache;
+}
+
+void free_cache_entry(CacheEntry *entry) {
+    free(entry->expr);
+    free(entry->vars);
+    free(entry->order);
+    free_bdd(entry->bdd);
+    free(entry);
+}
+
+void free_bdd_cache(BDDCache *cache) {
+    if (!cache) return;
+
+    CacheEntry *entry = cache->lru_head;
+    while (entry) {
+        CacheEntry *next = entry->lru_next;
+        free_cache_entry(entry);
+        entry = next;
+    }
+
+    free(cache->list);
+    free(cache);
+}
+
+void lru_unlink(BDDCache *cache, CacheEntry *entry) {
+    if (entry->lru_prev) entry->lru_prev->lru_next = entry->lru_next;
+    else cache->lru_head = entry->lru_next;
+
+    if (entry->lru_next) entry->lru_next->lru_prev = entry->lru_prev;
+    else cache->lru_tail = entry->lru_prev;
+
+    entry->lru_prev = NULL;
+    entry->lru_next = NULL;
+}
+
+void lru_push_front(BDDCache *cache, CacheEntry *entry) {
+    entry->lru_prev = NULL;
+    entry->lru_next = cache->lru_head;
+    if (cache->lru_head) cache->lru_head->lru_prev = entry;
+    cache->lru_head = entry;
+    if (!cache->lru_tail) cache->lru_tail = entry;
+}
+
+CacheEntry *cache_search(BDDCache *cache, const char *expr, const char *vars) {
+    CacheEntry *current = cache->list[hash_key(cache, expr, vars)];
+    while (current) {
+        if (strcmp(current->expr, expr) == 0 && strcmp(current->vars, vars) == 0) {
+            return current;
+        }
+        current = current->next;
+    }
+    return NULL;
+}
+
+// removes the least recently used entry from both the hash list and the LRU list
+void cache_evict(BDDCache *cache) {
+    CacheEntry *victim = cache->lru_tail;
+    if (!victim) return;
+
+    lru_unlink(cache, victim);
+
+    CacheEntry **link = &cache->list[hash_key(cache, victim->expr, victim->vars)];
+    while (*link && *link != victim) link = &(*link)->next;
+    if (*link) *link = victim->next;
+
+    free_cache_entry(victim);
+    cache->count--;
+    cache->evictions++;
+}
+
+// takes ownership of expr, vars, order and bdd
+CacheEntry *cache_insert(BDDCache *cache, char *expr, char *vars, char *order, BDD *bdd) {
+    while (cache->count >= cache->capacity) {
+        cache_evict(cache);
+    }
+
+    CacheEntry *entry = calloc(1, sizeof(CacheEntry));
+    entry->expr = expr;
+    entry->vars = vars;
+    entry->order = order;
+    entry->bdd = bdd;
+
+    unsigned int idx = hash_key(cache, expr, vars);
+    entry->next = cache->list[idx];
+    cache->list[idx] = entry;
+    lru_push_front(cache, entry);
+    cache->count++;
+
+    return entry;
+}
+
+// builds the BDD create_BDD_with_best_order returns once it has found order,
+// which for an empty order is its constant case rather than create_BDD
+BDD *create_BDD_with_known_order(char *expr, char *order) {
+    if (!*order) return create_BDD_with_best_order(expr, order);
+    return create_BDD(expr, order);
+}
+
+// same as create_BDD_with_best_order, but repeated queries skip parsing and the order search.
+// the returned BDD belongs to the cache: don't free it, and don't use it after
+// the next call that can evict it or after free_bdd_cache
+BDD *create_BDD_with_best_order_cached(BDDCache *cache, char *expr, char *var_seq) {
+    if (!cache || !expr || !var_seq) return NULL;
+
+    char *norm_expr = normalize_expression(expr);
+    char *norm_vars = normalize_vars(var_seq);
+
+    CacheEntry *entry = cache_search(cache, norm_expr, norm_vars);
+    if (entry) {
+        cache->hits++;
+        lru_unlink(cache, entry);
+        lru_push_front(cache, entry);
+
+        if (!entry->bdd) {      // order was loaded from disk, only the build itself is left
+            entry->bdd = create_BDD_with_known_order(expr, entry->order);
+        }
+
+        free(norm_expr);
+        free(norm_vars);
+        return entry->bdd;
+    }
+
+    cache->misses++;
+    BDD *best = create_BDD_with_best_order(expr, norm_vars);       // the normalized expression is only the key
+    entry = cache_insert(cache, norm_expr, norm_vars, strdup(best->var_order), best);
+    return entry->bdd;
+}
+
+double bdd_cache_hit_rate(BDDCache *cache) {
+    if (!cache) return 0.0;
+    long total = cache->hits + cache->misses;
+    if (total == 0) return 0.0;
+    return (double)cache->hits / total * 100.0;
+}
+
+#define CACHE_LINE_SIZE 8192
+
+// an order is only usable for the vars it was learned for
+int is_permutation(const char *order, const char *vars) {
+    if (strlen(order) != strlen(vars)) return 0;
+
+    int counts[256] = {0};
+    for (int i = 0; vars[i]; i++) counts[(unsigned char)vars[i]]++;
+    for (int i = 0; order[i]; i++) {
+        if (--counts[(unsigned char)order[i]] < 0) return 0;
+    }
+    return 1;
+}
+
+// writes learned orders as "expression<TAB>vars<TAB>order" lines, least recently used first
+// so that load_bdd_cache restores the same LRU order. normalized fields never contain
+// whitespace, so empty fields are written as they are. entries too long to be read back are skipped.
+// returns the number of entries written, less than cache->count if some were skipped, 0 on a write error
+int save_bdd_cache_file(BDDCache *cache, FILE *file) {
+    if (!cache || !file) return 0;
+
+    int saved = 0;
+    for (CacheEntry *entry = cache->lru_tail; entry; entry = entry->lru_prev) {
+        size_t length = strlen(entry->expr) + strlen(entry->vars) + strlen(entry->order) + 3;
+        if (length >= CACHE_LINE_SIZE - 1) continue;
+
+        if (fprintf(file, "%s\t%s\t%s\n", entry->expr, entry->vars, entry->order) < 0) return 0;
+        saved++;
+    }
+
+    if (fflush(file) != 0 || ferror(file)) return 0;
+    return saved;
+}
+
+int save_bdd_cache(BDDCache *cache, const char *path) {
+    if (!cache || !path) return 0;
+
+    FILE *file = fopen(path, "w");
+    if (!file) return 0;
+
+    int saved = save_bdd_cache_file(cache, file);
+    if (fclose(file) != 0) return 0;
+    return saved;
+}
+
+// reads orders written by save_bdd_cache; BDDs are rebuilt lazily on the first hit.
+// malformed lines and orders that aren't a permutation of their vars are skipped
+int load_bdd_cache_file(BDDCache *cache, FILE *file) {
+    if (!cache || !file) return 0;
+
+    char line[CACHE_LINE_SIZE];
+    int loaded = 0;
+
+    while (fgets(line, sizeof(line), file)) {
+        char *end = strchr(line, '\n');
+        if (!end && !feof(file)) {      // line is longer than the buffer, skip the rest of it
+            int c;
+            while ((c = fgetc(file)) != EOF && c != '\n');
+            continue;
+        }
+        if (end) *end = '\0';
+
+        size_t length = strlen(line);
+        if (length > 0 && line[length - 1] == '\r') line[length - 1] = '\0';
+
+        char *expr = line;
+        char *vars = strchr(expr, '\t');
+        if (!vars) continue;
+        *vars++ = '\0';
+
+        char *order = strchr(vars, '\t');
+        if (!order) continue;
+        *order++ = '\0';
+        if (strchr(order, '\t')) continue;
+
+        char *norm_expr = normalize_expression(expr);
+        char *norm_vars = normalize_vars(vars);
+        char *norm_order = normalize_vars(order);
+
+        int valid = strcmp(norm_expr, expr) == 0 &&         // fields must already be in normalized form
+                    strcmp(norm_vars, vars) == 0 &&
+                    strcmp(norm_order, order) == 0 &&
+                    is_permutation(norm_order, norm_vars);
+
+        if (!valid || cache_search(cache, norm_expr, norm_vars)) {
+            free(norm_expr);
+            free(norm_vars);
+            free(norm_order);
+            continue;
+        }
+
+        cache_insert(cache, norm_expr, norm_vars, norm_order, NULL);
+        loaded++;
+    }
+
+    return loaded;
+}
+
+int load_bdd_cache(BDDCache *cache, const char *path) {
+    if (!cache || !path) return 0;
+
+    FILE *file = fopen(path, "r");
+    if (!file) return 0;
+
+    int loaded = load_bdd_cache_file(cache, file);
+    fclose(file);
+    return loaded;
+}
+
 char BDD_use(BDD *bdd, char *input_bits) {
     if (!bdd || !input_bits) return -1;
 
@@ -469,6 +795,377 @@ char BDD_use(BDD *bdd, char *input_bits) {
     return (node == &TRUE) ? '1' : '0';
 }
 
+// ZDD uses the same nodes and unique table as BDD, only the reduction rule differs:
+// a node whose high child is FALSE is removed, while a node with low == high is kept.
+// a ZDD built from an expression is the family of its minterms (cubes), every cube is the set
+// of its literals. x and !x are separate ZDD variables stored like in Minterm (c and -c),
+// so a literal missing from a cube is suppressed and costs no node
+BDDNode *find_or_add_zdd_node(HashTable *hash_table, char var, BDDNode *low, BDDNode *high) {
+    if (high == &FALSE) return low;
+
+    BDDNode *existing = search(hash_table, var, low, high);
+    if (existing) {return existing;}
+
+    BDDNode *node = create_node(var);
+    node->low = low;
+    node->high = high;
+
+    insert_node(hash_table, var, low, high, node);
+
+    return node;
+}
+
+int minterm_contains(Minterm *m, signed char literal) {
+    for (int i = 0; i < m->var_count; i++) {
+        if (m->vars[i] == literal) return 1;
+    }
+    return 0;
+}
+
+// keeps the cubes that contain the literal (with == 1, the literal is removed from them)
+// or the cubes that don't contain it (with == 0)
+Expression *cube_cofactor(Expression *expr, signed char literal, int with) {
+    Expression *result = calloc(1, sizeof(Expression));
+    Minterm *prev = NULL;
+
+    for (Minterm *m = expr->head; m; m = m->next) {
+        if (m->zero_flag || minterm_contains(m, literal) != with) continue;
+
+        Minterm *copy = calloc(1, sizeof(Minterm));
+        if (m->var_count > 0) {
+            copy->vars = malloc(m->var_count * sizeof(signed char));
+        }
+        for (int i = 0; i < m->var_count; i++) {
+            if (m->vars[i] != literal) {
+                copy->vars[copy->var_count++] = m->vars[i];
+            }
+        }
+
+        if (!result->head) {
+            result->head = copy;
+        } else {
+            prev->next = copy;
+        }
+        prev = copy;
+        result->minterm_length++;
+    }
+
+    if (!result->head) {
+        result->zero_flag = 1;
+    }
+
+    return result;
+}
+
+// literal_order holds x, !x for every variable of the order, every cube literal has to be in it
+BDDNode *build_zdd(Expression *expression, char *literal_order, int level, HashTable *hash_table) {
+    if (expression->zero_flag) return &FALSE;
+
+    signed char current = literal_order[level];
+    if (!current) {                     // all literals are used up, so a cube left here is the empty set
+        for (Minterm *m = expression->head; m; m = m->next) {
+            if (!m->zero_flag && m->var_count == 0) return &TRUE;
+        }
+        return &FALSE;
+    }
+
+    int found = 0;
+    for (Minterm *m = expression->head; m && !found; m = m->next) {
+        found = !m->zero_flag && minterm_contains(m, current);
+    }
+
+    if (!found) {       // no cube has this literal, it is suppressed
+        return build_zdd(expression, literal_order, level + 1, hash_table);
+    }
+
+    Expression *f_high = cube_cofactor(expression, current, 1);
+    Expression *f_low = cube_cofactor(expression, current, 0);
+
+    BDDNode *high_node = build_zdd(f_high, literal_order, level + 1, hash_table);
+    BDDNode *low_node = build_zdd(f_low, literal_order, level + 1, hash_table);
+
+    free_expression(f_high);
+    free_expression(f_low);
+
+    return find_or_add_zdd_node(hash_table, current, low_node, high_node);
+}
+
+// abc -> a !a b !b c !c
+char *create_literal_order(char *var_seq) {
+    int count = strlen(var_seq);
+    char *order = malloc(2 * count + 1);
+
+    for (int i = 0; i < count; i++) {
+        signed char var = tolower(var_seq[i]);
+        order[2 * i] = var;
+        order[2 * i + 1] = -var;
+    }
+    order[2 * count] = '\0';
+
+    return order;
+}
+
+// returns NULL if the expression uses a variable that isn't in var_seq
+ZDD *create_ZDD(char *expression, char *var_seq) {
+    if (!var_seq) return NULL;
+
+    char *order = create_literal_order(var_seq);
+    Expression *expr = parse(expression);
+
+    for (Minterm *m = expr->head; m; m = m->next) {
+        for (int i = 0; i < m->var_count; i++) {
+            if (!strchr(order, m->vars[i])) {
+                free_expression(expr);
+                free(order);
+                return NULL;
+            }
+            if (minterm_contains(m, -m->vars[i])) {     // x!x is never true, it isn't a cube
+                m->zero_flag = 1;
+            }
+        }
+    }
+
+    ZDD *zdd = calloc(1, sizeof(ZDD));
+    zdd->hash_table = create_hash_table(HASH_SIZE);
+    zdd->var_order = order;
+    zdd->root = build_zdd(expr, order, 0, zdd->hash_table);
+    free_expression(expr);
+
+    return zdd;
+}
+
+void free_zdd(ZDD *zdd) {
+    if (!zdd) return;
+
+    free_hash_table(zdd->hash_table);
+    free(zdd->var_order);
+    free(zdd);
+}
+
+// table of already computed operations, its nodes belong to another table so only entries are freed
+void free_computed_table(HashTable *table) {
+    if (!table) return;
+
+    for (int i = 0; i < table->size; i++) {
+        HashEntry *entry = table->list[i];
+        while (entry) {
+            HashEntry *next = entry->next;
+            free(entry);
+            entry = next;
+        }
+    }
+
+    free(table->list);
+    free(table);
+}
+
+// position of the node variable in the order, terminals are below all variables
+int zdd_level(char *var_order, BDDNode *node) {
+    if (node == &TRUE || node == &FALSE) return INT_MAX;
+
+    char *pos = strchr(var_order, node->var);
+    return pos ? (int)(pos - var_order) : INT_MAX - 1;
+}
+
+// op is 'u' union, 'i' intersection, 'd' difference or 'c' copy of p.
+// the result is built in hash_table, so operands may come from other ZDDs
+BDDNode *zdd_apply(char op, BDDNode *p, BDDNode *q, char *var_order, HashTable *hash_table, HashTable *computed) {
+    if (op == 'c' || (op != 'i' && q == &FALSE)) {
+        if (p == &TRUE || p == &FALSE) return p;
+        op = 'c';
+        q = NULL;
+    } else if (op == 'u' && p == &FALSE) {
+        return zdd_apply('c', q, NULL, var_order, hash_table, computed);
+    } else if (op == 'i' && (p == &FALSE || q == &FALSE)) {
+        return &FALSE;
+    } else if (op == 'd' && (p == &FALSE || p == q)) {
+        return &FALSE;
+    } else if (p == q) {        // union or intersection of a family with itself
+        return zdd_apply('c', p, NULL, var_order, hash_table, computed);
+    }
+
+    if ((op == 'u' || op == 'i') && p > q) {        // both are commutative, so one entry serves both orders
+        BDDNode *temp = p;
+        p = q;
+        q = temp;
+    }
+
+    BDDNode *existing = search(computed, op, p, q);
+    if (existing) {return existing;}
+
+    int p_level = zdd_level(var_order, p);
+    int q_level = op == 'c' ? INT_MAX : zdd_level(var_order, q);
+    BDDNode *result;
+
+    if (op == 'c') {
+        result = find_or_add_zdd_node(hash_table, p->var,
+                                      zdd_apply('c', p->low, NULL, var_order, hash_table, computed),
+                                      zdd_apply('c', p->high, NULL, var_order, hash_table, computed));
+    } else if (p_level < q_level) {         // sets containing p->var are not in q at all
+        BDDNode *low = zdd_apply(op, p->low, q, var_order, hash_table, computed);
+        if (op == 'i') {
+            result = low;
+        } else {
+            result = find_or_add_zdd_node(hash_table, p->var, low,
+                                          zdd_apply('c', p->high, NULL, var_order, hash_table, computed));
+        }
+    } else if (p_level > q_level) {         // sets containing q->var are not in p at all
+        if (op == 'u') {
+            result = find_or_add_zdd_node(hash_table, q->var,
+                                          zdd_apply(op, p, q->low, var_order, hash_table, computed),
+                                          zdd_apply('c', q->high, NULL, var_order, hash_table, computed));
+        } else {
+            result = zdd_apply(op, p, q->low, var_order, hash_table, computed);
+        }
+    } else {
+        result = find_or_add_zdd_node(hash_table, p->var,
+                                      zdd_apply(op, p->low, q->low, var_order, hash_table, computed),
+                                      zdd_apply(op, p->high, q->high, var_order, hash_table, computed));
+    }
+
+    insert_node(computed, op, p, q, result);
+    return result;
+}
+
+ZDD *zdd_operation(char op, ZDD *a, ZDD *b) {
+    if (!a || !b || strcmp(a->var_order, b->var_order) != 0) return NULL;
+
+    ZDD *zdd = calloc(1, sizeof(ZDD));
+    zdd->hash_table = create_hash_table(HASH_SIZE);
+    zdd->var_order = strdup(a->var_order);
+
+    HashTable *computed = create_hash_table(HASH_SIZE);
+    zdd->root = zdd_apply(op, a->root, b->root, zdd->var_order, zdd->hash_table, computed);
+    free_computed_table(computed);
+
+    return zdd;
+}
+
+ZDD *zdd_union(ZDD *a, ZDD *b) {
+    return zdd_operation('u', a, b);
+}
+
+ZDD *zdd_intersection(ZDD *a, ZDD *b) {
+    return zdd_operation('i', a, b);
+}
+
+ZDD *zdd_difference(ZDD *a, ZDD *b) {
+    return zdd_operation('d', a, b);
+}
+
+typedef struct CountEntry {
+    BDDNode *node;
+    unsigned long count;
+    struct CountEntry *next;        // for collisions
+} CountEntry;
+
+unsigned long count_sets(BDDNode *node, CountEntry **memo) {
+    if (node == &FALSE) return 0;
+    if (node == &TRUE) return 1;
+
+    unsigned int idx = hash(node->var, node->low, node->high);
+    for (CountEntry *entry = memo[idx]; entry; entry = entry->next) {
+        if (entry->node == node) return entry->count;
+    }
+
+    CountEntry *entry = malloc(sizeof(CountEntry));
+    entry->node = node;
+    entry->count = count_sets(node->low, memo) + count_sets(node->high, memo);
+    entry->next = memo[idx];
+    memo[idx] = entry;
+
+    return entry->count;
+}
+
+// number of sets in the family, for a ZDD from create_ZDD it is the number of distinct cubes
+unsigned long zdd_count(ZDD *zdd) {
+    if (!zdd) return 0;
+
+    CountEntry **memo = calloc(HASH_SIZE, sizeof(CountEntry*));
+    unsigned long count = count_sets(zdd->root, memo);
+
+    for (int i = 0; i < HASH_SIZE; i++) {
+        CountEntry *entry = memo[i];
+        while (entry) {
+            CountEntry *next = entry->next;
+            free(entry);
+            entry = next;
+        }
+    }
+    free(memo);
+
+    return count;
+}
+
+int zdd_eval(BDDNode *node, char *bit_map) {
+    if (node == &FALSE) return 0;
+    if (node == &TRUE) return 1;
+
+    signed char literal = node->var;
+    int idx = abs(literal) - 'a';
+    if (idx < 0 || idx >= 26 || bit_map[idx] == -1) return -1;
+
+    int low = zdd_eval(node->low, bit_map);
+    if (low != 0) return low;
+
+    int literal_value = literal > 0 ? bit_map[idx] : !bit_map[idx];
+    return literal_value ? zdd_eval(node->high, bit_map) : 0;
+}
+
+// value of the function the cube family describes, i.e. the OR of its cubes
+char ZDD_use(ZDD *zdd, char *input_bits) {
+    if (!zdd || !input_bits) return -1;
+
+    char bit_map[26];
+    for (int i = 0; i < 26; ++i) bit_map[i] = -1;
+
+    for (int i = 0; input_bits[i] && i < 26; ++i) {
+        char ch = input_bits[i];
+        if (ch == '0') bit_map[i] = 0;
+        else if (ch == '1') bit_map[i] = 1;
+        else return -1;
+    }
+
+    int result = zdd_eval(zdd->root, bit_map);
+    if (result == -1) return -1;
+    return result ? '1' : '0';
+}
+
+// checks if a cube written like a minterm ("a!bc") is in the family
+int ZDD_contains(ZDD *zdd, char *cube) {
+    if (!zdd || !cube) return 0;
+
+    Expression *expr = parse(cube);
+    Minterm empty = {0};
+    Minterm *m = expr->head ? expr->head : &empty;
+    if (m->next) {
+        free_expression(expr);
+        return 0;
+    }
+
+    BDDNode *node = zdd->root;
+    int contains = 1;
+    for (int i = 0; zdd->var_order[i] && contains; i++) {
+        signed char literal = zdd->var_order[i];
+        int in_cube = minterm_contains(m, literal);
+
+        if (node == &TRUE || node == &FALSE || node->var != literal) {
+            if (in_cube) contains = 0;      // suppressed literal can't be in the cube
+            continue;
+        }
+
+        node = in_cube ? node->high : node->low;
+    }
+
+    int found_all = 1;
+    for (int i = 0; i < m->var_count; i++) {
+        if (!strchr(zdd->var_order, m->vars[i])) found_all = 0;
+    }
+
+    free_expression(expr);
+    return contains && found_all && node == &TRUE;
+}
+
 // void test_efficiency(char *expr, char *default_order) {
 //     clock_t start, end;
 
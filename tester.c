@@ -181,11 +181,322 @@ void test_bdd(int num_vars, int num_func) {
     printf("Number of nodes best order: %d\n", num_nodes_bo / num_func);
 }
 
+// runs every expression through the cache `repeats` times. every distinct BDD (built on a miss or
+// rebuilt from a loaded order) is checked once, hits have to return the BDD checked before
+int run_cache(BDDCache *cache, char **expressions, int num_func, char *order, int num_vars,
+              int repeats, double *time) {
+    BDD **first = calloc(num_func, sizeof(BDD*));
+    int correct = 1;
+    long evictions = cache->evictions;
+
+    for (int r = 0; r < repeats; r++) {
+        for (int i = 0; i < num_func; i++) {
+            long misses = cache->misses;
+            clock_t start = clock();
+            BDD *bdd = create_BDD_with_best_order_cached(cache, expressions[i], order);
+            clock_t end = clock();
+            *time += (double)(end - start) / CLOCKS_PER_SEC;
+
+            int built = cache->misses != misses;
+            if (built || bdd != first[i]) {
+                if (!built && first[i] && cache->evictions == evictions) {
+                    correct = 0;        // without evictions a hit returns the BDD built on the miss
+                }
+                if (!test_accuracy(bdd, expressions[i], order, num_vars)) {
+                    correct = 0;
+                }
+                first[i] = bdd;
+            }
+            if (cache->count > cache->capacity) {
+                correct = 0;
+            }
+        }
+    }
+
+    free(first);
+    return correct;
+}
+
+void test_cache(int num_vars, int num_func, int repeats) {
+    char *order = malloc((num_vars + 1) * sizeof(char));
+    for (int i = 0; i < num_vars; i++) {
+        order[i] = 'a' + i;
+    }
+    order[num_vars] = '\0';
+
+    char **expressions = malloc(num_func * sizeof(char*));
+    for (int i = 0; i < num_func; i++) {
+        expressions[i] = generate_random_boolean_function(num_vars);
+    }
+
+    double time = 0.0;
+    BDDCache *cache = create_bdd_cache(num_func);
+    int correct = run_cache(cache, expressions, num_func, order, num_vars, repeats, &time);
+
+    // capacity below the working set: cycling through all expressions misses and evicts every time
+    double small_time = 0.0;
+    int small_func = num_func / 4;
+    int capacity = small_func / 2;
+    BDDCache *small = create_bdd_cache(capacity);
+    int small_correct = run_cache(small, expressions, small_func, order, num_vars, 2, &small_time);
+    int small_evictions_ok = small->count == capacity && small->evictions == small->misses - capacity;
+
+    FILE *file = tmpfile();
+    int num_saved = save_bdd_cache_file(cache, file);
+    rewind(file);
+    BDDCache *loaded = create_bdd_cache(num_func);
+    int num_loaded = load_bdd_cache_file(loaded, file);
+    fclose(file);
+
+    double loaded_time = 0.0;
+    int loaded_correct = run_cache(loaded, expressions, num_func, order, num_vars, 1, &loaded_time);
+
+    printf("Cache repeats: %d\n", repeats);
+    printf("Cache accuracy: %s\n", correct ? "ok" : "failed");
+    printf("Cache hit rate: %.2f%%\n", bdd_cache_hit_rate(cache));
+    printf("Time with cache: %.2f seconds\n", time);
+    printf("Small cache (capacity %d) accuracy: %s, hit rate: %.2f%%, evictions: %ld, entries: %d\n",
+           capacity, small_correct && small_evictions_ok ? "ok" : "failed",
+           bdd_cache_hit_rate(small), small->evictions, small->count);
+    printf("Saved orders: %d of %d, loaded: %d, accuracy: %s, hit rate: %.2f%%\n",
+           num_saved, cache->count, num_loaded, loaded_correct ? "ok" : "failed", bdd_cache_hit_rate(loaded));
+
+    free_bdd_cache(cache);
+    free_bdd_cache(small);
+    free_bdd_cache(loaded);
+    for (int i = 0; i < num_func; i++) {
+        free(expressions[i]);
+    }
+    free(expressions);
+    free(order);
+}
+
+// sparse SOP: few short cubes over many variables, no variable twice in a cube
+char *generate_sparse_function(int num_vars, int num_terms, int max_literals) {
+    char *function = malloc(num_terms * (2 * max_literals + 1) + 1);
+    function[0] = '\0';
+
+    for (int i = 0; i < num_terms; i++) {
+        int term_length = rand() % max_literals + 1;
+        char used[26] = {0};
+
+        for (int j = 0; j < term_length; j++) {
+            int variable = rand() % num_vars;
+            if (used[variable]) continue;
+            used[variable] = 1;
+
+            if (rand() % 2 == 0) {
+                strcat(function, "!");
+            }
+            char letter = 'a' + variable;
+            strncat(function, &letter, 1);
+        }
+
+        if (i < num_terms - 1) {
+            strcat(function, "+");
+        }
+    }
+
+    return function;
+}
+
+// distinct non-contradictory cubes of the expression, literals written in variable order
+char **expression_cubes(char *expr, char *vars, int *count) {
+    Expression *parsed = parse(expr);
+    char **cubes = malloc((parsed->minterm_length + 1) * sizeof(char*));
+    *count = 0;
+
+    for (Minterm *m = parsed->head; m; m = m->next) {
+        char *cube = malloc(2 * strlen(vars) + 1);
+        int length = 0;
+        int contradictory = 0;
+
+        for (int i = 0; vars[i]; i++) {
+            int positive = minterm_contains(m, vars[i]);
+            int negative = minterm_contains(m, -vars[i]);
+            if (positive && negative) contradictory = 1;
+            if (negative) cube[length++] = '!';
+            if (positive || negative) cube[length++] = vars[i];
+        }
+        cube[length] = '\0';
+
+        int duplicate = 0;
+        for (int i = 0; i < *count && !duplicate; i++) {
+            duplicate = strcmp(cubes[i], cube) == 0;
+        }
+
+        if (contradictory || duplicate) {
+            free(cube);
+        } else {
+            cubes[(*count)++] = cube;
+        }
+    }
+
+    free_expression(parsed);
+    return cubes;
+}
+
+int has_cube(char **cubes, int count, char *cube) {
+    for (int i = 0; i < count; i++) {
+        if (strcmp(cubes[i], cube) == 0) return 1;
+    }
+    return 0;
+}
+
+void free_cubes(char **cubes, int count) {
+    for (int i = 0; i < count; i++) {
+        free(cubes[i]);
+    }
+    free(cubes);
+}
+
+// compares the ZDD family with the result of op ('u', 'i', 'd', 0 for a alone) on the cube lists
+int test_zdd_family(ZDD *zdd, char **a, int a_count, char **b, int b_count, char op) {
+    unsigned long expected_count = 0;
+    int correct = 1;
+
+    for (int i = 0; i < a_count; i++) {
+        int in_b = has_cube(b, b_count, a[i]);
+        int expected = op == 'i' ? in_b : op == 'd' ? !in_b : 1;
+        if (expected) expected_count++;
+        if (ZDD_contains(zdd, a[i]) != expected) correct = 0;
+    }
+
+    for (int i = 0; i < b_count && op; i++) {
+        if (has_cube(a, a_count, b[i])) continue;
+        int expected = op == 'u';
+        if (expected) expected_count++;
+        if (ZDD_contains(zdd, b[i]) != expected) correct = 0;
+    }
+
+    return correct && zdd_count(zdd) == expected_count;
+}
+
+// the ZDD has to describe the same function as the expression: every input
+// for up to 16 variables, random inputs above that
+int test_zdd_function(ZDD *zdd, char *expr, char *vars, int num_vars) {
+    char *combination = malloc((num_vars + 1) * sizeof(char));
+    int exhaustive = num_vars <= 16;
+    int number_combinations = exhaustive ? 1 << num_vars : 1000;
+    int correct = 1;
+
+    for (int i = 0; i < number_combinations && correct; i++) {
+        for (int j = 0; j < num_vars; j++) {
+            if (exhaustive) combination[j] = (i & (1 << (num_vars - j - 1))) ? '1' : '0';
+            else combination[j] = rand() % 2 ? '1' : '0';
+        }
+        combination[num_vars] = '\0';
+
+        if (ZDD_use(zdd, combination) != evaluate_expression(expr, vars, num_vars, combination)) {
+            correct = 0;
+        }
+    }
+
+    free(combination);
+    return correct;
+}
+
+// everything a diagram allocates: the struct, its order, the unique table with its buckets and the nodes
+long diagram_memory(HashTable *table, char *var_order, size_t struct_size) {
+    return (long)(struct_size + strlen(var_order) + 1 +
+                  sizeof(HashTable) + table->size * sizeof(HashEntry*) +
+                  table->num_nodes * (sizeof(BDDNode) + sizeof(HashEntry)));
+}
+
+// num_terms == 0 uses the random functions of test_bdd, otherwise sparse functions
+// with num_terms cubes of at most 3 literals
+void test_zdd(int num_vars, int num_func, int num_terms) {
+    char *order = malloc((num_vars + 1) * sizeof(char));
+    for (int i = 0; i < num_vars; i++) {
+        order[i] = 'a' + i;
+    }
+    order[num_vars] = '\0';
+
+    int total_correct = 0;
+    int total_ops_correct = 0;
+    double total_bdd_time = 0.0;
+    double total_zdd_time = 0.0;
+    long num_nodes_bdd = 0;
+    long num_nodes_zdd = 0;
+    long memory_bdd = 0;
+    long memory_zdd = 0;
+
+    for (int i = 0; i < num_func; i++) {
+        char *expression = num_terms ? generate_sparse_function(num_vars, num_terms, 3)
+                                     : generate_random_boolean_function(num_vars);
+        char *other = num_terms ? generate_sparse_function(num_vars, num_terms, 3)
+                                : generate_random_boolean_function(num_vars);
+
+        clock_t start_bdd = clock();
+        BDD *bdd = create_BDD(expression, order);
+        clock_t end_bdd = clock();
+        total_bdd_time += (double)(end_bdd - start_bdd) / CLOCKS_PER_SEC;
+
+        clock_t start_zdd = clock();
+        ZDD *zdd = create_ZDD(expression, order);
+        clock_t end_zdd = clock();
+        total_zdd_time += (double)(end_zdd - start_zdd) / CLOCKS_PER_SEC;
+
+        int a_count, b_count;
+        char **a = expression_cubes(expression, order, &a_count);
+        char **b = expression_cubes(other, order, &b_count);
+
+        if (test_zdd_function(zdd, expression, order, num_vars) &&
+            test_zdd_family(zdd, a, a_count, b, b_count, 0)) {
+            total_correct++;
+        }
+
+        ZDD *other_zdd = create_ZDD(other, order);
+        ZDD *zdd_u = zdd_union(zdd, other_zdd);
+        ZDD *zdd_i = zdd_intersection(zdd, other_zdd);
+        ZDD *zdd_d = zdd_difference(zdd, other_zdd);
+
+        if (test_zdd_family(zdd_u, a, a_count, b, b_count, 'u') &&
+            test_zdd_family(zdd_i, a, a_count, b, b_count, 'i') &&
+            test_zdd_family(zdd_d, a, a_count, b, b_count, 'd')) {
+            total_ops_correct++;
+        }
+
+        num_nodes_bdd += bdd->hash_table->num_nodes;
+        num_nodes_zdd += zdd->hash_table->num_nodes;
+        memory_bdd += diagram_memory(bdd->hash_table, bdd->var_order, sizeof(BDD));
+        memory_zdd += diagram_memory(zdd->hash_table, zdd->var_order, sizeof(ZDD));
+
+        free_bdd(bdd);
+        free_zdd(zdd);
+        free_zdd(other_zdd);
+        free_zdd(zdd_u);
+        free_zdd(zdd_i);
+        free_zdd(zdd_d);
+        free_cubes(a, a_count);
+        free_cubes(b, b_count);
+        free(expression);
+        free(other);
+    }
+
+    free(order);
+
+    if (num_terms) printf("ZDD on sparse functions: %d variables, %d cubes\n", num_vars, num_terms);
+    else printf("ZDD on random functions: %d variables\n", num_vars);
+    printf("ZDD accuracy: %.2f%%\n", (double)total_correct / num_func * 100.0);
+    printf("ZDD operations accuracy: %.2f%%\n", (double)total_ops_correct / num_func * 100.0);
+    printf("Time for BDD creation (compared to ZDD): %.2f seconds\n", total_bdd_time);
+    printf("Time for ZDD creation: %.2f seconds\n", total_zdd_time);
+    size_t node_memory = sizeof(BDDNode) + sizeof(HashEntry);     // every node has its unique table entry
+    printf("Number of nodes BDD: %.2f, node memory: %ld bytes, total memory: %ld bytes\n",
+           (double)num_nodes_bdd / num_func, (long)(num_nodes_bdd * node_memory / num_func), memory_bdd / num_func);
+    printf("Number of nodes ZDD: %.2f, node memory: %ld bytes, total memory: %ld bytes\n",
+           (double)num_nodes_zdd / num_func, (long)(num_nodes_zdd * node_memory / num_func), memory_zdd / num_func);
+}
+
 int main() {
     srand(time(NULL));
     int num_vars = 12;
     int num_func = 100;
 
     test_bdd(num_vars, num_func);
+    test_cache(num_vars, num_func, 10);
+    test_zdd(num_vars, num_func, 0);
+    test_zdd(26, num_func, 8);
     return 0;
 }